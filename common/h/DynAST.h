@@ -69,6 +69,7 @@ class ASTVisitor;
  class ConstantAST;
  class VariableAST;
  class RoseAST;
+ class SymEval;
  };
  // Stack analysis...
  class StackAST;
@@ -136,7 +137,8 @@ class name : public AST {						\
     return ((a->getID() == V_##name) ? boost::static_pointer_cast<name>(a) : Ptr()); \
   }									\
   const type &val() const { return t_; }				\
-  void setChild(int i, AST::Ptr a) { kids_[i] = a; };			\
+  void setChild(int i, AST::Ptr a) { assert(!interned_); kids_[i] = a; }; \
+  virtual AST::Ptr rebuild(const Children &kids) const { return create(t_, kids); } \
  private:								\
  name(type t, AST::Ptr a) : t_(t) { kids_.push_back(a); };		\
  name(type t, AST::Ptr a, AST::Ptr b) : t_(t) {				\
@@ -187,10 +189,14 @@ class COMMON_EXPORT AST : public boost::enable_shared_from_this<AST> {
   typedef boost::shared_ptr<AST> Ptr;
   typedef std::vector<AST::Ptr> Children;      
 
-  AST() {};
+  AST() : interned_(false) {};
   virtual ~AST() {};
   
   bool operator==(const AST &rhs) const {
+    if (this == &rhs) return true;
+    // Interned nodes are shared and only ever have interned children,
+    // so two of them are equal only if they are the same node
+    if (interned_ && rhs.interned_) return false;
     // make sure rhs and this have the same type
     return((typeid(*this) == typeid(rhs)) && isStrictEqual(rhs));
   }
@@ -228,8 +234,20 @@ class COMMON_EXPORT AST : public boost::enable_shared_from_this<AST> {
     assert(0);
   };
 
+  // A copy of this node with the given children, for changing an
+  // interned node, which must not be changed in place.
+  virtual Ptr rebuild(const Children &) const {
+    assert(0);
+    return Ptr();
+  };
+  bool interned() const { return interned_; }
+
  protected:
   virtual bool isStrictEqual(const AST &rhs) const = 0;
+
+  // Set by DataflowAPI::SymEval::intern
+  bool interned_;
+  friend class DataflowAPI::SymEval;
 };
 
  class COMMON_EXPORT ASTVisitor {
@@ -971,6 +971,30 @@ COMMON_EXPORT int ia32_decode_opcode(unsigned int capa,
 COMMON_EXPORT ia32_instruction& ia32_decode(unsigned int capabilities,
         const unsigned char* addr, ia32_instruction&);
 
+/**
+ * The length and control-flow class of an instruction, as computed by
+ * ia32_decode_length.
+ */
+struct ia32_cf_info
+{
+    unsigned int size;         /* length in bytes; at least 1 even if invalid */
+    unsigned int legacy_type;  /* IS_CALL, IS_JUMP, IS_JCC, IS_RET, INDIR, REL_*, ... */
+    entryID id;                /* e_No_Entry if the instruction is invalid */
+    int rel_position;          /* position of the relative branch offset, -1 if none */
+    unsigned int rel_size;     /* size of the relative branch offset */
+    bool lock;                 /* carries a LOCK prefix */
+};
+
+/**
+ * A fast alternative to ia32_decode for callers that only need to know
+ * how long an instruction is and whether it transfers control. Prefixes
+ * and the opcode are decoded from the usual tables; operand decoding is
+ * replaced by table-driven ModRM/SIB/displacement and immediate sizing,
+ * and no locations, memory accesses or operands are produced. Returns
+ * true if the instruction is valid.
+ */
+COMMON_EXPORT bool ia32_decode_length(const unsigned char* addr, ia32_cf_info& info);
+
 
 enum dynamic_call_address_mode {
   REGISTER_DIRECT, REGISTER_INDIRECT,
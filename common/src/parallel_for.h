@@ -0,0 +1,103 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(PARALLEL_FOR_H_)
+#define PARALLEL_FOR_H_
+
+#include <stddef.h>
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+
+#include "common/src/dthread.h"
+
+/*
+ * Minimal fork/join helper for the analyses that can farm independent
+ * work items (functions, compilation units, stacks) out to a fixed
+ * number of threads.  Items are handed out one at a time from a shared
+ * cursor so that uneven item sizes balance out; the calling thread
+ * takes part in the loop.  With one thread, or one item, the loop runs
+ * inline and in order, so serial behavior is exactly preserved.
+ */
+namespace parallel_detail {
+
+template <typename Body>
+class loop {
+ public:
+    loop(size_t n, Body &body) : next_(0), n_(n), body_(body) { }
+
+    void run() {
+        size_t i;
+        while(claim(i))
+            body_(i);
+    }
+
+ private:
+    bool claim(size_t &i) {
+        ScopeLock<> l(lock_);
+        if(next_ >= n_)
+            return false;
+        i = next_++;
+        return true;
+    }
+
+    Mutex<false> lock_;
+    size_t next_;
+    size_t n_;
+    Body &body_;
+};
+
+}
+
+inline unsigned hardware_threads()
+{
+    unsigned n = boost::thread::hardware_concurrency();
+    return n ? n : 1;
+}
+
+template <typename Body>
+void parallel_for(unsigned nthreads, size_t n, Body body)
+{
+    if(nthreads <= 1 || n <= 1) {
+        for(size_t i = 0; i < n; ++i)
+            body(i);
+        return;
+    }
+    if(nthreads > n)
+        nthreads = (unsigned) n;
+
+    parallel_detail::loop<Body> l(n, body);
+    boost::thread_group workers;
+    for(unsigned t = 1; t < nthreads; ++t)
+        workers.create_thread(boost::bind(&parallel_detail::loop<Body>::run, &l));
+    l.run();
+    workers.join_all();
+}
+
+#endif
@@ -32,5 +32,23 @@
 //  defines for sha1.C, checksum string length
 #define SHA1_DIGEST_LEN 20
 #define SHA1_STRING_LEN (SHA1_DIGEST_LEN * 2 + 1)
+
+#include "common/h/util.h"
+#include "common/src/Types.h"
+
+typedef struct {
+    uint32_t state[5];
+    uint32_t count[2];
+    unsigned char buffer[64];
+} SHA1_CTX;
+
+// incremental interface, for hashing data that is not in a single file
+COMMON_EXPORT void SHA1Init(SHA1_CTX* context);
+COMMON_EXPORT void SHA1Update(SHA1_CTX* context, unsigned char* data, uint32_t len);
+// SHA1Update may transform its input in place; this hashes read-only
+// bytes through a scratch copy
+COMMON_EXPORT void SHA1UpdateConst(SHA1_CTX* context, const void* data, size_t len);
+COMMON_EXPORT void SHA1Final(unsigned char digest[SHA1_DIGEST_LEN], SHA1_CTX* context);
+
 char *sha1_file(const char *filename, char *result_ptr = NULL);
 #endif
@@ -0,0 +1,224 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(STRIPED_HASH_MAP_H_)
+#define STRIPED_HASH_MAP_H_
+
+#include <vector>
+#include <utility>
+#include <functional>
+
+#include "dyntypes.h"
+#include "common/src/dthread.h"
+
+/*
+ * A hash map that may be read and written from many threads at once.
+ * Keys are spread over a fixed number of stripes, each of which is an
+ * ordinary dyn_hash_map guarded by its own lock; threads touching
+ * different stripes never contend.
+ *
+ * Lookups hand back copies of the mapped values, so V should be cheap
+ * to copy (pointers, enums, shared pointers).  Iteration through
+ * for_each() locks one stripe at a time and is only a consistent
+ * snapshot if no writers are active.
+ */
+template <typename K, typename V, unsigned NStripes = 64>
+class striped_hash_map {
+ public:
+    typedef K key_type;
+    typedef V mapped_type;
+
+    striped_hash_map() { }
+
+    bool find(const K &key, V &val) const {
+        const stripe &s = stripe_for(key);
+        ScopeLock<> l(s.lock);
+        typename map_t::const_iterator it = s.map.find(key);
+        if(it == s.map.end())
+            return false;
+        val = it->second;
+        return true;
+    }
+
+    bool contains(const K &key) const {
+        const stripe &s = stripe_for(key);
+        ScopeLock<> l(s.lock);
+        return s.map.find(key) != s.map.end();
+    }
+
+    // Inserts only if the key is absent; returns whether it was inserted.
+    bool insert(const K &key, const V &val) {
+        stripe &s = stripe_for(key);
+        ScopeLock<> l(s.lock);
+        return s.map.insert(std::make_pair(key, val)).second;
+    }
+
+    // Inserts if absent; otherwise hands back the value already present.
+    // Either way `val' holds the mapped value on return.
+    bool insert_or_get(const K &key, V &val) {
+        stripe &s = stripe_for(key);
+        ScopeLock<> l(s.lock);
+        std::pair<typename map_t::iterator, bool> r =
+            s.map.insert(std::make_pair(key, val));
+        if(!r.second)
+            val = r.first->second;
+        return r.second;
+    }
+
+    // Inserts or overwrites
+    void set(const K &key, const V &val) {
+        stripe &s = stripe_for(key);
+        ScopeLock<> l(s.lock);
+        s.map[key] = val;
+    }
+
+    bool erase(const K &key) {
+        stripe &s = stripe_for(key);
+        ScopeLock<> l(s.lock);
+        return s.map.erase(key) > 0;
+    }
+
+    // Removes the key, handing back the value it mapped to.
+    bool take(const K &key, V &val) {
+        stripe &s = stripe_for(key);
+        ScopeLock<> l(s.lock);
+        typename map_t::iterator it = s.map.find(key);
+        if(it == s.map.end())
+            return false;
+        val = it->second;
+        s.map.erase(it);
+        return true;
+    }
+
+    // Calls f(val) with the key's stripe locked on the value mapped to
+    // key, default-constructing it first if absent, and returns what f
+    // returns.  f must not touch the map.
+    template <typename F>
+    bool update(const K &key, F f) {
+        stripe &s = stripe_for(key);
+        ScopeLock<> l(s.lock);
+        return f(s.map[key]);
+    }
+
+    // Erases the entries for which f(key, val) returns true, locking one
+    // stripe at a time; f may also modify the values it is handed.
+    template <typename F>
+    void erase_if(F f) {
+        for(unsigned i = 0; i < NStripes; ++i) {
+            ScopeLock<> l(stripes_[i].lock);
+            typename map_t::iterator it = stripes_[i].map.begin();
+            while(it != stripes_[i].map.end()) {
+                if(f(it->first, it->second))
+                    stripes_[i].map.erase(it++);
+                else
+                    ++it;
+            }
+        }
+    }
+
+    // Erases the key if f(val) returns true for the value it maps to.
+    template <typename F>
+    bool erase_if(const K &key, F f) {
+        stripe &s = stripe_for(key);
+        ScopeLock<> l(s.lock);
+        typename map_t::iterator it = s.map.find(key);
+        if(it == s.map.end() || !f(it->second))
+            return false;
+        s.map.erase(it);
+        return true;
+    }
+
+    size_t size() const {
+        size_t ret = 0;
+        for(unsigned i = 0; i < NStripes; ++i) {
+            ScopeLock<> l(stripes_[i].lock);
+            ret += stripes_[i].map.size();
+        }
+        return ret;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    void clear() {
+        for(unsigned i = 0; i < NStripes; ++i) {
+            ScopeLock<> l(stripes_[i].lock);
+            stripes_[i].map.clear();
+        }
+    }
+
+    template <typename F>
+    void for_each(F f) const {
+        for(unsigned i = 0; i < NStripes; ++i) {
+            ScopeLock<> l(stripes_[i].lock);
+            typename map_t::const_iterator it = stripes_[i].map.begin();
+            for( ; it != stripes_[i].map.end(); ++it)
+                f(it->first, it->second);
+        }
+    }
+
+    // Copies out the contents; see the caveat on for_each()
+    void entries(std::vector<std::pair<K, V> > &out) const {
+        for(unsigned i = 0; i < NStripes; ++i) {
+            ScopeLock<> l(stripes_[i].lock);
+            out.insert(out.end(),
+                stripes_[i].map.begin(), stripes_[i].map.end());
+        }
+    }
+
+ private:
+    typedef dyn_hash_map<K, V> map_t;
+
+    struct stripe {
+        mutable Mutex<false> lock;
+        map_t map;
+    };
+
+    stripe &stripe_for(const K &key) {
+        return stripes_[index_of(key)];
+    }
+    const stripe &stripe_for(const K &key) const {
+        return stripes_[index_of(key)];
+    }
+    static unsigned index_of(const K &key) {
+        // addresses are usually aligned; fold the high bits in so that
+        // neighbouring keys land in different stripes
+        size_t h = std::hash<K>()(key);
+        h ^= (h >> 7) ^ (h >> 17);
+        return (unsigned)(h % NStripes);
+    }
+
+    // non-copyable
+    striped_hash_map(const striped_hash_map &);
+    striped_hash_map &operator=(const striped_hash_map &);
+
+    stripe stripes_[NStripes];
+};
+
+#endif
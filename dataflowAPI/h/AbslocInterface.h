@@ -38,6 +38,10 @@
 #include "Operand.h"
 #include "Absloc.h"
 #include "util.h"
+#include "dyntypes.h"
+
+#include <map>
+#include <vector>
 
 class int_function;
 class BPatch_function;
@@ -109,13 +113,21 @@ class AbsRegionConverter {
   bool definedCache(Address, ParseAPI::Function *, std::vector<AbsRegion> &defined);
 
   // Caching mechanism...
-  typedef std::vector<AbsRegion> RegionVec;
+  // The cached regions of one function in one flat array, with each
+  // instruction's used and defined regions a run (first, count) in it.
+  typedef std::pair<unsigned, unsigned> Run;
+
+  struct FuncRegions {
+    std::vector<AbsRegion> regions;
+    dyn_hash_map<Address, Run> used;
+    dyn_hash_map<Address, Run> defined;
+  };
+  typedef std::map<ParseAPI::Function *, FuncRegions> FuncCache;
 
-  typedef std::map<Address, RegionVec> AddrCache;
-  typedef std::map<ParseAPI::Function *, AddrCache> FuncCache;
+  Run store(FuncRegions &fr, const std::vector<AbsRegion> &regions);
+  void load(const FuncRegions &fr, Run run, std::vector<AbsRegion> &regions);
 
-  FuncCache used_cache_;
-  FuncCache defined_cache_;
+  FuncCache cache_;
   bool cacheEnabled_;
   bool stackAnalysisEnabled_;
 };
@@ -146,10 +158,17 @@ class AssignmentConverter {
 			   std::vector<Assignment::Ptr> &assignments);
 
   bool cache(ParseAPI::Function *func, Address addr, std::vector<Assignment::Ptr> &assignments);
-
-  typedef std::vector<Assignment::Ptr> AssignmentVec;
-  typedef std::map<Address, AssignmentVec> AddrCache;
-  typedef std::map<ParseAPI::Function *, AddrCache> FuncCache;
+  void store(ParseAPI::Function *func, Address addr, std::vector<Assignment::Ptr> &assignments);
+
+  // The cached assignments of one function in one flat array, with
+  // each instruction's assignments a run in it.  The Assignments
+  // themselves are still allocated one at a time.
+  struct FuncAssignments {
+    std::vector<Assignment::Ptr> assigns;
+    // first assignment and count for each instruction
+    dyn_hash_map<Address, std::pair<unsigned, unsigned> > index;
+  };
+  typedef std::map<ParseAPI::Function *, FuncAssignments> FuncCache;
 
   FuncCache cache_;
   bool cacheEnabled_;
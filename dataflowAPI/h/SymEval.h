@@ -355,6 +355,20 @@ public:
   // prior results from the Graph
   // are substituted into anything that uses them.
   DATAFLOW_EXPORT static Retval_t expand(Dyninst::Graph::Ptr slice, DataflowAPI::Result_t &res);
+
+  // Expansions of single instructions are cached, keyed by address,
+  // instruction bytes and architecture, and shared by every caller in
+  // the process.  The size is a number of instructions; 0 turns the
+  // cache off.
+  DATAFLOW_EXPORT static void setCacheSize(size_t insns);
+  DATAFLOW_EXPORT static void clearCache();
+  DATAFLOW_EXPORT static void cacheStats(size_t &hits, size_t &misses);
+
+  // Returns the shared AST structurally equal to ast, so that equal
+  // expressions are one node and compare equal by address.  Parts of
+  // ast may become part of the result.  Interned nodes must not be
+  // changed with setChild; AST::substitute copies them instead.
+  DATAFLOW_EXPORT static AST::Ptr intern(AST::Ptr ast);
   
  private:
 
@@ -363,6 +377,11 @@ public:
  static bool expandInsn(const InstructionPtr insn,
 			 const uint64_t addr,
 			 Result_t& res);
+ static bool expandInsnCached(const InstructionPtr insn,
+			       const uint64_t addr,
+			       Result_t& res);
+
+ static AST::Ptr intern(AST::Ptr ast, std::map<AST *, AST::Ptr> &done);
 
  static Retval_t process(SliceNodePtr ptr, Result_t &dbase, std::set<Edge::Ptr> &skipEdges);
   
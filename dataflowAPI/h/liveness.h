@@ -42,6 +42,8 @@
 #include "ABI.h"
 #include <map>
 #include <set>
+#include <string>
+#include <vector>
 
 
 using namespace Dyninst;
@@ -73,12 +75,39 @@ class DATAFLOW_EXPORT LivenessAnalyzer{
 	int width;
 	ABI* abi;
 
+	// Results of analyzeAll: each function's blocks in address order, and
+	// their live-in and live-out sets packed liveWords words to a set.
+	struct FuncLiveness {
+		std::vector<ParseAPI::Block *> blocks;
+		std::vector<bitArray::block_type> in, out;
+	};
+	std::map<ParseAPI::Function*, FuncLiveness> allLiveness;
+	size_t liveBits, liveWords;
+
+	void solveFunction(ParseAPI::Function *func, FuncLiveness &fl);
+	bool findAllLiveness(ParseAPI::Function *func, ParseAPI::Block *block,
+	                     bitArray *in, bitArray *out);
+	bitArray unpack(const bitArray::block_type *words) const;
+	void hashCode(const std::vector<ParseAPI::Block *> &blocks,
+	              unsigned char *digest) const;
+	bitArray liveIn(ParseAPI::Function *func, ParseAPI::Block *block);
+	bitArray liveOut(ParseAPI::Function *func, ParseAPI::Block *block);
+
 public:
 	typedef enum {Before, After} Type;
 	typedef enum {Invalid_Location} ErrorType;
 	LivenessAnalyzer(int w);
 	void analyze(ParseAPI::Function *func);
 
+	// Analyzes every function in the object up front, on up to nthreads
+	// threads, and answers later queries on them from the results.
+	void analyzeAll(ParseAPI::CodeObject *co, unsigned nthreads);
+	// Writes the analyzeAll results to a file, to be read back by
+	// loadAll for the same binary.  Both return false on failure;
+	// loadAll keeps nothing from a file that does not match co.
+	bool saveAll(const std::string &file);
+	bool loadAll(ParseAPI::CodeObject *co, const std::string &file);
+
 	template <class OutputIterator>
 	bool query(ParseAPI::Location loc, Type type, OutputIterator outIter){
 		bitArray liveRegs;
@@ -137,11 +137,19 @@ class Slicer {
   typedef std::pair<InstructionPtr, Address> InsnInstance;
   typedef std::vector<InsnInstance> InsnVec;
 
+  class Session;
+
   DATAFLOW_EXPORT Slicer(AssignmentPtr a,
 	 ParseAPI::Block *block,
 	 ParseAPI::Function *func,
 	 bool cache = true,
 	 bool stackAnalysis = true);
+
+  // Slice within the function of `session', building on the
+  // slices already taken from it
+  DATAFLOW_EXPORT Slicer(AssignmentPtr a,
+	 ParseAPI::Block *block,
+	 Session &session);
     
   DATAFLOW_EXPORT static bool isWidenNode(Node::Ptr n);
 
@@ -687,16 +695,12 @@ private:
 
   void mergeRecursiveCaches(std::map<Address, DefCache>& sc, std::map<Address, DefCache>& c, Address a);
 
-  InsnCache insnCache_;
+  GraphPtr copyReachable(GraphPtr g, Direction dir, SliceNode::Ptr start);
 
   AssignmentPtr a_;
   ParseAPI::Block *b_;
   ParseAPI::Function *f_;
 
-
-  // Assignments map to unique slice nodes
-  std::unordered_map<AssignmentPtr, SliceNode::Ptr, Assignment::AssignmentPtrHasher> created_;
-
   // cache to prevent edge duplication
   struct EdgeTupleHasher {
     size_t operator() (const EdgeTuple& et) const {
@@ -705,23 +709,75 @@ private:
 	return seed;
     }
   };
-  std::unordered_map<EdgeTuple, int, EdgeTupleHasher> unique_edges_;
 
   // map of previous active maps. these are used to end recursion.
   typedef std::map<AbsRegion, std::set<Element> > PrevMap;
   std::map<Address, PrevMap> prev_maps;
 
-  // set of plausible entry/exit nodes.
-  std::set<SliceNode::Ptr> plausibleNodes;
-
   // a stack and set of addresses that mirror our recursion.
   // these are used to detect loops and properly merge cache.
   std::deque<Address> addrStack;
   std::set<Address> addrSet;
 
-  AssignmentConverter converter;
+ public:
+  /*
+   * What the slices within one function can share: the decoded
+   * instructions and converted assignments, and for each direction
+   * the slice graph, def caches and visited edges found so far.
+   *
+   * A slice that reaches code an earlier slice of the session has
+   * searched links to the definitions found then, as a single slice
+   * does when it reaches the same code along a second path, and its
+   * graph is the part of the session's graph that it reaches. This
+   * assumes that all slices of a session use predicates that decide
+   * alike for the same assignment; a predicate requesting a cache
+   * clear drops the def caches of the session.
+   */
+  class Session {
+   public:
+    DATAFLOW_EXPORT Session(ParseAPI::Function *func,
+                            bool stackAnalysis = true);
+
+    ParseAPI::Function *func() const { return func_; }
+
+    // Forget the slices taken so far; decoded instructions and
+    // converted assignments are kept
+    DATAFLOW_EXPORT void clear();
+
+   private:
+    friend class Slicer;
+
+    Session(ParseAPI::Function *func, bool cache, bool stackAnalysis);
+
+    struct State {
+      GraphPtr graph;
+      std::map<CacheEdge, std::set<AbsRegion> > visited;
+      std::map<Address, DefCache> single;
+      std::map<Address, DefCache> cache;
+
+      // Assignments map to unique slice nodes
+      std::unordered_map<AssignmentPtr, SliceNode::Ptr, Assignment::AssignmentPtrHasher> created;
+      std::unordered_map<EdgeTuple, int, EdgeTupleHasher> unique_edges;
+
+      // set of plausible entry/exit nodes.
+      std::set<SliceNode::Ptr> plausible;
+
+      SliceNode::Ptr widen;
+    };
+
+    ParseAPI::Function *func_;
+    InsnCache insns_;
+    AssignmentConverter converter_;
+    State fwd_;
+    State bwd_;
+  };
+
+ private:
+  // The session in use; a Slicer built without one has its own
+  boost::shared_ptr<Session> own_;
+  Session *session_;
+  Session::State *state_;
 
-  SliceNode::Ptr widen_;
  public: 
   // A set of edges that have been visited during slicing,
   // which can be used for external users to figure out
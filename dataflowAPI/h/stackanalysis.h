@@ -39,6 +39,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 // To define StackAST
 #include "DynAST.h"
@@ -65,6 +66,7 @@ namespace Dyninst {
       class Function;
       class Block;
       class Edge;
+      class CodeObject;
    };
    namespace InstructionAPI {
       class Instruction;
@@ -515,6 +517,19 @@ public:
    DATAFLOW_EXPORT bool canGetFunctionSummary();
    DATAFLOW_EXPORT bool getFunctionSummary(TransferSet &summary);
 
+   // Analyzes every function in co on up to nthreads threads.  Callees
+   // are analyzed before their callers so that calls use the callee's
+   // summary, and the functions of a call graph cycle are summarized
+   // together to a fixed point.  Each function is annotated with its
+   // results as if it had been queried on its own, replacing any earlier
+   // results in place, so that existing StackAnalysis objects see the
+   // new ones; a function whose analysis fails keeps its earlier results.
+   // If summaries is given, it receives the function summaries keyed by
+   // entry address.
+   DATAFLOW_EXPORT static void analyzeAll(ParseAPI::CodeObject *co,
+      unsigned nthreads,
+      std::map<Address, TransferSet> *summaries = NULL);
+
    DATAFLOW_EXPORT void debug();
 
 private:
@@ -526,9 +541,15 @@ private:
 
    bool analyze();
    bool genInsnEffects();
+   // Replace the function's annotations with this analysis's results
+   void publishAnnos();
+   const AbslocState *findState(ParseAPI::Block *b, Address addr) const;
    void summarizeBlocks(bool verbose = false);
    void summarize();
 
+   void numberBlocks();
+   unsigned blockNum(ParseAPI::Block *b) const;
+
    void fixpoint(bool verbose = false);
    void summaryFixpoint();
 
@@ -545,8 +566,8 @@ private:
       const DefHeightSet &s2);
    void meet(const AbslocState &source, AbslocState &accum);
    void meetSummary(const TransferSet &source, TransferSet &accum);
-   AbslocState getSrcOutputLocs(ParseAPI::Edge* e);
-   TransferSet getSummarySrcOutputLocs(ParseAPI::Edge *e);
+   const AbslocState &getSrcOutputLocs(ParseAPI::Edge* e);
+   const TransferSet &getSummarySrcOutputLocs(ParseAPI::Edge *e);
    void computeInsnEffects(ParseAPI::Block *block, InstructionPtr insn,
       const Offset off, TransferFuncs &xferFunc, TransferSet &funcSummary);
 
@@ -621,15 +642,26 @@ private:
    InstructionEffects *insnEffects;  // Pointer so we can make it an annotation
    CallEffects *callEffects;  // Pointer so we can make it an annotation
 
-   BlockState blockInputs;
-   BlockState blockOutputs;
+   // The blocks reachable from the entry, numbered in the order they are
+   // first reached; the per-block state below is indexed by number.  The
+   // state of each block is still a map keyed by Absloc.
+   std::vector<ParseAPI::Block *> blocks;
+   dyn_hash_map<ParseAPI::Block *, unsigned> blockNums;
+
+   std::vector<AbslocState> blockInputs;
+   std::vector<AbslocState> blockOutputs;
+   // Blocks that fixpoint() has taken off its worklist
+   std::vector<bool> blockVisited;
 
    // Like blockInputs and blockOutputs, but used for function summaries.
    // Instead of tracking Heights, we track transfer functions.
-   BlockSummaryState blockSummaryInputs;
-   BlockSummaryState blockSummaryOutputs;
+   std::vector<TransferSet> blockSummaryInputs;
+   std::vector<TransferSet> blockSummaryOutputs;
 
    Intervals *intervals_; // Pointer so we can make it an annotation
+   // Whether results are shared through the function's annotations;
+   // analyzeAll builds them privately and publishes them when done
+   bool annotate_;
 
    FuncCleanAmounts funcCleanAmounts;
    int word_size;
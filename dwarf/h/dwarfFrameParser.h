@@ -94,6 +94,49 @@ public:
             std::vector<VariableLocation> &locs,
             FrameErrors_t &err_result);
 
+    // A rule for recovering a register of the caller's frame, compiled
+    // from the CFI.  Rules that need a full DWARF expression are left
+    // Unsupported; getRegValueAtFrame still evaluates those.
+    struct UnwindRule {
+        typedef enum {
+            Undefined,      // the value cannot be recovered
+            SameValue,      // unchanged from the current frame
+            Saved,          // saved in memory at CFA + offset
+            CFAOffset,      // equal to CFA + offset
+            RegOffset,      // equal to reg + offset
+            Unsupported
+        } Kind;
+
+        Kind kind;
+        MachRegister reg;
+        long offset;
+        UnwindRule() : kind(Unsupported), offset(0) {}
+    };
+
+    // How to find the canonical frame address and the caller's return
+    // address and frame pointer anywhere in [low, high)
+    struct UnwindRow {
+        Address low;
+        Address high;
+        UnwindRule cfa;
+        UnwindRule ra;
+        UnwindRule fp;
+    };
+
+    // Find the row covering pc.  Each row is compiled from the CFI the
+    // first time a PC in it is looked up and kept, sorted, for the life
+    // of the parser, so later lookups are a binary search that takes no
+    // lock once the row has been merged into the published table.  A PC
+    // without an FDE is remembered as well.  Safe to call from several
+    // threads.
+    bool getUnwindRow(Address pc,
+            UnwindRow &row,
+            FrameErrors_t &err_result);
+
+    // Drop the compiled rows, e.g. once no walker uses this library.
+    // They are compiled again if needed.
+    void clearUnwindRows();
+
 
 private:
 
@@ -126,6 +169,13 @@ private:
 
     void setupFdeData();
 
+    bool compileUnwindRow(Address pc,
+            UnwindRow &row,
+            FrameErrors_t &err_result);
+    bool addUnwindRow(Address pc,
+            UnwindRow &row,
+            FrameErrors_t &err_result);
+
     struct frameParser_key
     {
         Dwarf * dbg;
@@ -179,6 +229,9 @@ private:
     
     std::vector<Dwarf_CFI *> cfi_data;
 
+    struct UnwindTable;
+    UnwindTable * unwind_table;
+
 };
 
 }
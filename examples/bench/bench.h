@@ -0,0 +1,89 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*
+ * Timing and driver code shared by the benchmark examples.
+ */
+
+#if !defined(EXAMPLES_BENCH_H_)
+#define EXAMPLES_BENCH_H_
+
+#include <stdlib.h>
+#include <vector>
+#include <sys/time.h>
+
+#include <boost/thread/thread.hpp>
+
+// Wall-clock time in seconds
+static inline double benchNow()
+{
+   struct timeval tv;
+   gettimeofday(&tv, NULL);
+   return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+// The thread counts to measure: 1, 2, 4, ... up to the maximum given as
+// argv[arg], which defaults to the number of hardware threads.
+static inline std::vector<unsigned> benchThreadCounts(int argc, char *argv[],
+                                                      int arg)
+{
+   unsigned max_threads = boost::thread::hardware_concurrency();
+   if (argc > arg)
+      max_threads = atoi(argv[arg]);
+   if (max_threads == 0)
+      max_threads = 1;
+
+   std::vector<unsigned> counts;
+   for (unsigned t = 1; t < max_threads; t *= 2)
+      counts.push_back(t);
+   counts.push_back(max_threads);
+   return counts;
+}
+
+// Calls run(threads, baseline) for each thread count.  run returns the
+// time it measured; baseline is the time of the first run, or 0 during it.
+template <typename Run>
+static void benchScaling(const std::vector<unsigned> &counts, Run run)
+{
+   double baseline = 0;
+   for (unsigned i = 0; i < counts.size(); i++) {
+      double elapsed = run(counts[i], baseline);
+      if (i == 0)
+         baseline = elapsed;
+   }
+}
+
+// The speedup of elapsed over baseline, 1 for the baseline run itself
+static inline double benchSpeedup(double baseline, double elapsed)
+{
+   return baseline > 0 ? baseline / elapsed : 1.0;
+}
+
+#endif
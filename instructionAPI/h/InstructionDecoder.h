@@ -50,6 +50,45 @@ namespace Dyninst
     ///
       class InstructionDecoderImpl;
 
+    /// A %DecodedInstruction is a compact, value-type summary of one instruction, as produced by
+    /// InstructionDecoder::decodeBulk.  It carries no pointers and owns no memory, so arrays of
+    /// them can be allocated once and reused for any number of bulk decodes.
+    ///
+    /// \c offset is relative to the position of the decoder when \c decodeBulk was called.
+    /// For relative branches and calls, \c immediate holds the signed branch displacement;
+    /// use \c target to compute the destination.
+    struct DecodedInstruction
+    {
+        enum Flags
+        {
+            Valid = 1 << 0,           ///< the bytes form a legal instruction
+            Call = 1 << 1,
+            Return = 1 << 2,
+            Branch = 1 << 3,
+            Conditional = 1 << 4,     ///< conditional branch, including loops and jcxz
+            Indirect = 1 << 5,        ///< control flow target is in a register or memory
+            Relative = 1 << 6,        ///< control flow target is relative to the next instruction
+            FallThrough = 1 << 7,     ///< same meaning as Instruction::allowsFallThrough
+            HasDisplacement = 1 << 8,
+            HasImmediate = 1 << 9,
+            PCRelativeData = 1 << 10  ///< memory operand is addressed relative to the PC
+        };
+
+        unsigned int offset;
+        unsigned char size;
+        unsigned char category;       ///< an InsnCategory, as given by entryToCategory
+        unsigned short flags;
+        entryID id;
+        long long displacement;
+        long long immediate;
+
+        bool is(Flags f) const { return (flags & f) != 0; }
+        bool isValid() const { return is(Valid); }
+        InsnCategory getCategory() const { return static_cast<InsnCategory>(category); }
+        /// The destination of a relative branch or call, given the address at which decoding began.
+        Address target(Address base) const { return base + offset + size + immediate; }
+    };
+
     class INSTRUCTION_EXPORT InstructionDecoder
     {
       friend class Instruction;
@@ -73,6 +112,21 @@ namespace Dyninst
       /// the size of the instruction decoded.
       Instruction::Ptr decode(const unsigned char* buffer);
       void doDelayedDecode(const Instruction* insn_to_complete);
+      /// Decode up to \c max instructions sequentially from this %InstructionDecoder object's buffer
+      /// into the caller-provided array \c out, and return the number decoded.  Decoding stops early
+      /// at the end of the buffer or at an instruction that would extend past it.  Invalid byte
+      /// sequences are recorded without the \c Valid flag, and decoding continues after them;
+      /// bytes from which no instruction length can be decoded are recorded as entries as long as
+      /// the architecture's shortest instruction (one byte on x86, four on ARM and Power).
+      /// The buffer is advanced past the decoded instructions, so repeated calls sweep a whole range.
+      /// On x86 and x86-64 no memory is allocated and no %Instruction objects are built.
+      size_t decodeBulk(DecodedInstruction* out, size_t max);
+      /// As \c decodeBulk, for callers that only need the length and control flow behavior of each
+      /// instruction.  Only \c offset, \c size, \c id, \c category and the control flow flags are
+      /// filled in; \c immediate holds the offset of a relative branch or call, so that \c target
+      /// is valid.  On x86 and x86-64 operands are sized rather than decoded, which makes this
+      /// cheaper than \c decodeBulk.
+      size_t decodeControlFlow(DecodedInstruction* out, size_t max);
       struct INSTRUCTION_EXPORT buffer
       {
           const unsigned char* start;
@@ -73,6 +73,8 @@ namespace Dyninst
       
                 INSTRUCTION_EXPORT virtual void setMode(bool is64);
                 virtual void doDelayedDecode(const Instruction* insn_to_complete);
+                virtual size_t decodeBulk(InstructionDecoder::buffer& b, DecodedInstruction* out, size_t max);
+                virtual size_t decodeControlFlow(InstructionDecoder::buffer& b, DecodedInstruction* out, size_t max);
 
             protected:
       
@@ -95,6 +97,8 @@ namespace Dyninst
 
             private:
                 void doIA32Decode(InstructionDecoder::buffer& b);
+                size_t sweep(InstructionDecoder::buffer& b, DecodedInstruction* out, size_t max,
+                             bool controlFlowOnly);
 		bool isDefault64Insn();
 		
                 static TLS_VAR ia32_locations* locs;
@@ -38,6 +38,8 @@
 #include "Instruction.h"
 #include "InstructionDecoder.h" // buffer...anything else?
 
+#include <boost/thread/tss.hpp>
+
 namespace Dyninst
 {
 namespace InstructionAPI
@@ -51,6 +53,8 @@ class InstructionDecoderImpl
         virtual ~InstructionDecoderImpl() {}
         virtual Instruction::Ptr decode(InstructionDecoder::buffer& b);
         virtual void doDelayedDecode(const Instruction* insn_to_complete) = 0;
+        virtual size_t decodeBulk(InstructionDecoder::buffer& b, DecodedInstruction* out, size_t max);
+        virtual size_t decodeControlFlow(InstructionDecoder::buffer& b, DecodedInstruction* out, size_t max);
         virtual void setMode(bool is64) = 0;
         static Ptr makeDecoderImpl(Architecture a);
 
@@ -77,7 +81,9 @@ class InstructionDecoderImpl
     protected:
         Operation::Ptr m_Operation;
         Architecture m_Arch;
-        static std::map<Architecture, Ptr> impls;
+        // Decoders carry per-instruction scratch state, so each thread
+        // gets its own set
+        static boost::thread_specific_ptr<std::map<Architecture, Ptr> > impls;
       
 };
 
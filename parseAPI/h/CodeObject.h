@@ -42,6 +42,9 @@
 #include "ParseContainers.h"
 
 namespace Dyninst {
+namespace InsnAdapter {
+class IA_IAPI;
+}
 namespace ParseAPI {
 
 /** A CodeObject defines a collection of binary code, for example a binary,
@@ -129,6 +132,37 @@ class CodeObject {
     PARSER_EXPORT CFGFactory * fact() const { return _fact; }
     PARSER_EXPORT bool defensiveMode() { return defensive; }
 
+    /*
+     * Number of threads used by parse().  With more than one thread,
+     * the instructions of the functions being parsed are decoded by a
+     * pool of workers that stay a bounded distance ahead of the parse,
+     * while the CFG itself is still built by a single thread in one
+     * deterministic pass, so the result matches a serial parse.
+     * Defaults to 1.
+     */
+    PARSER_EXPORT void setParseThreads(unsigned n);
+    PARSER_EXPORT unsigned parseThreads() const;
+
+    /*
+     * Directory for the persistent CFG cache.  When set, parse() first
+     * looks there for a CFG previously built from an identical binary
+     * and restores it instead of parsing; otherwise it parses as usual
+     * and saves the result.  The cache is not used in defensive mode,
+     * when parse callbacks are registered, or after on-demand parsing.
+     * Empty (the default) disables the cache.
+     */
+    PARSER_EXPORT void setParseCacheDir(const std::string & dir);
+    PARSER_EXPORT std::string parseCacheDir() const;
+
+    /*
+     * Compute dominators, post-dominators, loops and the loop tree of
+     * every function up front, spreading the functions over
+     * parseThreads() threads.  Forces parsing and finalization to
+     * complete first.  The per-function queries on Function return
+     * the same results whether or not this has been called.
+     */
+    PARSER_EXPORT void analyzeLoops();
+
     PARSER_EXPORT bool isIATcall(Address insn, std::string &calleeName);
 
     // This is for callbacks; it is often much more efficient to 
@@ -169,6 +203,10 @@ class CodeObject {
     friend void Function::finalize();
     // allows Function entry blocks to be moved to new regions
     friend void Function::setEntryBlock(Block *);
+    // allows instruction adapters to pick up prefetched instructions
+    friend class InsnAdapter::IA_IAPI;
+
+    static void analyze_func_loops(Function *);
 
   private:
     CodeSource * _cs;
@@ -118,6 +118,17 @@ class IA_IAPI : public InstructionAdapter {
         virtual bool isThunk() const = 0;
 	virtual bool isIndirectJump() const;
 
+        // Run the jump table analysis for this indirect jump ahead of
+        // time, against version of the function's CFG. If the jump is
+        // later parsed as a jump table of currFunc, getNewEdges uses the
+        // stored result instead of analyzing again.
+        void precomputeJumpTable(Dyninst::ParseAPI::Function * currFunc,
+                                 Dyninst::ParseAPI::Block * currBlk,
+                                 unsigned version);
+        bool precomputedJumpTable(unsigned version) const {
+            return jumpTableFunc != NULL && jumpTableVersion == version;
+        }
+
 protected:
         virtual bool isRealCall() const;
         virtual bool parseJumpTable(Dyninst::ParseAPI::Function * currFunc,
@@ -135,6 +146,10 @@ protected:
 
         Dyninst::InstructionAPI::InstructionDecoder dec;
 
+        // Decode the instruction at `current', preferring one that was
+        // decoded ahead of time by parallel parsing
+        Dyninst::InstructionAPI::Instruction::Ptr fetchInsn();
+
         /*
          * Decoded instruction cache: contains the linear
          * sequence of instructions decoded by the decoder
@@ -161,6 +176,14 @@ protected:
 
         mutable std::map<ParseAPI::EdgeTypeEnum, bool> tailCalls;
 
+        // Result of precomputeJumpTable, valid for jumpTableAddr while
+        // the function's CFG is still at jumpTableVersion
+        Dyninst::ParseAPI::Function * jumpTableFunc;
+        Address jumpTableAddr;
+        bool jumpTableResult;
+        unsigned jumpTableVersion;
+        std::vector<std::pair<Address, Dyninst::ParseAPI::EdgeTypeEnum> > jumpTableEdges;
+
         static std::map<Architecture, Dyninst::InstructionAPI::RegisterAST::Ptr> framePtr;
         static std::map<Architecture, Dyninst::InstructionAPI::RegisterAST::Ptr> stackPtr;
         static std::map<Architecture, Dyninst::InstructionAPI::RegisterAST::Ptr> thePC;
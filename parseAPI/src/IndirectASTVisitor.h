@@ -25,6 +25,8 @@ using namespace Dyninst::DataflowAPI;
 class SimplifyVisitor: public ASTVisitor {
     Address addr;
     bool keepMultiOne;
+    // Interned nodes can be reached more than once; each is simplified once
+    map<AST*, AST::Ptr> done;
 public:
     using ASTVisitor::visit;
     virtual ASTPtr visit(DataflowAPI::RoseAST *ast);
@@ -37,6 +37,8 @@
 #include "dyntypes.h"
 #include "IBSTree.h"
 #include "IBSTree-fast.h"
+#include "common/src/dthread.h"
+#include "common/src/striped_hash_map.h"
 #include "CodeObject.h"
 #include "CFG.h"
 #include "ParserDetails.h"
@@ -62,7 +64,8 @@ class ParseFrame {
         PARSED,
         FRAME_ERROR,
         BAD_LOOKUP,  // error for lookups that return Status
-        FRAME_DELAYED // discovered cyclic dependency, delaying parse
+        FRAME_DELAYED, // discovered cyclic dependency, delaying parse
+        JUMP_TABLE_PENDING // only jump tables left, waiting to resolve them
     };
 
     /* worklist details */
@@ -124,6 +127,11 @@ class ParseFrame {
 
     ParseWorkElem * seed; // stored for cleanup
 
+    // Bumped each time a jump table adds to func's CFG.  A parked frame
+    // has nothing else left to parse, so after it resumes only its jump
+    // tables can change the graph their analysis is based on.
+    unsigned cfg_version;
+
     ParseFrame(Function * f,ParseData *pd) :
         curAddr(0),
         num_insns(0),
@@ -131,6 +139,7 @@ class ParseFrame {
         func(f),
         codereg(f->region()),
         seed(NULL),
+        cfg_version(0),
         _pd(pd)
     {
         set_status(UNPARSED);
@@ -145,20 +154,28 @@ class ParseFrame {
     ParseData * _pd;
 };
 
-/* per-CodeRegion parsing data */
+/* per-CodeRegion parsing data 
+ *
+ * The by-address tables may be queried and updated from several
+ * threads at once. The interval trees are not concurrent; anybody
+ * touching funcsByRange or blocksByRange directly must hold range_lock.
+ */
 class region_data { 
  public:
   // Function lookups
   Dyninst::IBSTree_fast<FuncExtent> funcsByRange;
-    dyn_hash_map<Address, Function *> funcsByAddr;
+    striped_hash_map<Address, Function *> funcsByAddr;
 
     // Block lookups
     Dyninst::IBSTree_fast<Block> blocksByRange;
-    dyn_hash_map<Address, Block *> blocksByAddr;
+    striped_hash_map<Address, Block *> blocksByAddr;
+
+    // Guards funcsByRange and blocksByRange
+    mutable Mutex<false> range_lock;
 
     // Parsing internals 
-    dyn_hash_map<Address, ParseFrame *> frame_map;
-    dyn_hash_map<Address, ParseFrame::Status> frame_status;
+    striped_hash_map<Address, ParseFrame *> frame_map;
+    striped_hash_map<Address, ParseFrame::Status> frame_status;
 
     Function * findFunc(Address entry);
     Block * findBlock(Address entry);
@@ -174,6 +191,7 @@ class region_data {
         Block * nextBlock = NULL;
         Address nextBlockAddr = numeric_limits<Address>::max();
 
+        ScopeLock<> l(range_lock);
         if((nextBlock = blocksByRange.successor(addr)) &&
            nextBlock->start() > addr)
         {
@@ -192,20 +210,16 @@ class region_data {
 inline Function *
 region_data::findFunc(Address entry)
 {
-    dyn_hash_map<Address, Function *>::iterator fit;
-    if((fit = funcsByAddr.find(entry)) != funcsByAddr.end())
-        return fit->second;
-    else
-        return NULL;
+    Function * ret = NULL;
+    funcsByAddr.find(entry,ret);
+    return ret;
 }
 inline Block *
 region_data::findBlock(Address entry)
 {
-    dyn_hash_map<Address, Block *>::iterator bit;
-    if((bit = blocksByAddr.find(entry)) != blocksByAddr.end())
-        return bit->second;
-    else
-        return NULL;
+    Block * ret = NULL;
+    blocksByAddr.find(entry,ret);
+    return ret;
 }
 inline int
 region_data::findFuncs(Address addr, set<Function *> & funcs)
@@ -215,7 +229,10 @@ region_data::findFuncs(Address addr, set<Function *> & funcs)
     set<FuncExtent *> extents;
     set<FuncExtent *>::iterator eit;
     
-    funcsByRange.find(addr,extents);
+    {
+        ScopeLock<> l(range_lock);
+        funcsByRange.find(addr,extents);
+    }
     for(eit = extents.begin(); eit != extents.end(); ++eit)
         funcs.insert((*eit)->func());
  
@@ -230,7 +247,10 @@ region_data::findFuncs(Address start, Address end, set<Function *> & funcs)
     set<FuncExtent *> extents;
     set<FuncExtent *>::iterator eit;
     
-    funcsByRange.find(&dummy,extents);
+    {
+        ScopeLock<> l(range_lock);
+        funcsByRange.find(&dummy,extents);
+    }
     for(eit = extents.begin(); eit != extents.end(); ++eit)
         funcs.insert((*eit)->func());
  
@@ -241,6 +261,7 @@ region_data::findBlocks(Address addr, set<Block *> & blocks)
 {
     int sz = blocks.size();
 
+    ScopeLock<> l(range_lock);
     blocksByRange.find(addr,blocks);
     return blocks.size() - sz;
 }
@@ -328,11 +349,12 @@ inline region_data * StandardParseData::findRegion(CodeRegion * /* cr */)
 }
 inline void StandardParseData::record_func(Function *f)
 {
-    _rdata.funcsByAddr[f->addr()] = f;
+    _rdata.funcsByAddr.set(f->addr(),f);
 }
 inline void StandardParseData::record_block(CodeRegion * /* cr */, Block *b)
 {
-    _rdata.blocksByAddr[b->start()] = b;
+    _rdata.blocksByAddr.set(b->start(),b);
+    ScopeLock<> l(_rdata.range_lock);
     _rdata.blocksByRange.insert(b);
 }
 
@@ -34,6 +34,9 @@
 #include <vector>
 #include <queue>
 #include <utility>
+#include <atomic>
+#include <map>
+#include <memory>
 
 #include "dyntypes.h"
 #include "IBSTree.h"
@@ -45,8 +48,12 @@
 #include "CFG.h"
 #include "ParseCallback.h"
 
+#include <boost/thread/thread.hpp>
+
 #include "ParseData.h"
 #include "common/src/dthread.h"
+#include "common/src/striped_hash_map.h"
+#include "common/src/sha1.h"
 
 using namespace std;
 
@@ -97,6 +104,31 @@ class Parser {
     // a sink block for unbound edges
     Block * _sink;
 
+    // worker threads available to parse(); 1 parses serially
+    unsigned _num_threads;
+
+    // instructions decoded ahead of CFG construction by parallel parsing;
+    // each is dropped once the parse consumes it
+    striped_hash_map<Address, InstructionAPI::Instruction::Ptr> _prefetched;
+    // instructions in _prefetched, which the workers keep below a bound
+    std::atomic<size_t> _prefetch_count;
+    bool _prefetch_active;
+    // one bit per byte of each region, set once a worker has decoded
+    // the instruction starting there
+    std::map<CodeRegion *, std::unique_ptr<std::atomic<unsigned char>[]> >
+        _prefetch_claims;
+    // the workers run alongside the parse until release_prefetched
+    boost::thread * _prefetch_thread;
+    std::atomic<bool> _prefetch_stop;
+    CondVar<> _prefetch_room;
+
+    // frames waiting for their jump tables to be resolved in parallel
+    vector<ParseFrame *> _jump_table_frames;
+    bool _defer_jump_tables;
+
+    // directory holding persistent CFG caches; empty disables caching
+    std::string _cache_dir;
+
     enum ParseState {
         UNPARSED,       // raw state
         PARTIAL,        // parsing has started
@@ -138,6 +170,16 @@ class Parser {
     CFGFactory & factory() const { return _cfgfact; }
     CodeObject & obj() { return _obj; }
 
+    // parallel parsing
+    void set_num_threads(unsigned n) { _num_threads = n ? n : 1; }
+    unsigned num_threads() const { return _num_threads; }
+    bool prefetching() const { return _prefetch_active; }
+    InstructionAPI::Instruction::Ptr prefetched_insn(Address addr);
+
+    // persistent CFG cache
+    void set_cache_dir(const std::string & dir) { _cache_dir = dir; }
+    const std::string & cache_dir() const { return _cache_dir; }
+
     // removal
     void remove_block(Block *);
     void remove_func(Function *);
@@ -155,6 +197,24 @@ class Parser {
  private:
     void parse_vanilla();
     void parse_gap_heuristic(CodeRegion *cr);
+
+    // parallel instruction prefetch (Parser-parallel.C)
+    bool can_prefetch();
+    void prefetch_funcs(vector<Function *> & funcs);
+    void prefetch_run(vector<Function *> funcs);
+    void prefetch_func(Function * f);
+    bool prefetch_claim(CodeRegion * cr, Address addr);
+    bool prefetch_wait();
+    void release_prefetched();
+    void resolve_jump_tables(vector<ParseFrame *> & work);
+
+    // persistent CFG cache (Parser-cache.C)
+    bool can_cache();
+    void cache_key(unsigned char key[SHA1_DIGEST_LEN]);
+    std::string cache_path(const unsigned char key[SHA1_DIGEST_LEN]);
+    bool load_cache();
+    bool save_cache();
+
     void probabilistic_gap_parsing(CodeRegion* cr);
     //void parse_sbp();
 
@@ -188,6 +248,7 @@ class Parser {
     void parse_frame(ParseFrame & frame,bool);
 
     void resumeFrames(Function * func, vector<ParseFrame *> & work);
+    Block * jump_table_block(ParseFrame & frame, ParseWorkElem * work);
     
     // defensive parsing details
     void tamper_post_processing(std::vector<ParseFrame *>&, ParseFrame *);
@@ -174,10 +174,33 @@ class ProbabilityCalculator {
     typedef dyn_hash_map<Address, DecodeData > DecodeCache;
     DecodeCache decodeCache;
 
+    // The idiom extraction results for every byte offset in a range,
+    // used by the batch scoring pass in place of decodeCache
+    struct DecodeTable {
+        Address lo;
+        std::vector<DecodeData> data;
+        const DecodeData *find(Address addr) const;
+    };
+
+    // A range of candidate offsets scored by one task of the batch pass
+    struct ScoreTask {
+        Address start;
+        Address end;
+        std::vector<double> probs;
+    };
+    struct ScoreBody;
+
+    // Match the idiom model at addr, decoding through table if given
+    // and through decodeCache otherwise
+    double matchIdioms(Address addr, const DecodeTable *table);
+    void scoreRange(ScoreTask &t);
+
     // Recursively mathcing normal idioms and calculate weights
-    double calcForwardWeights(int cur, Address addr, IdiomPrefixTree *tree, bool &valid);
+    double calcForwardWeights(int cur, Address addr, IdiomPrefixTree *tree, bool &valid,
+                              const DecodeTable *table);
     // Recursively mathcing prefix idioms and calculate weights
-    double calcBackwardWeights(int cur, Address addr, IdiomPrefixTree *tree, std::set<IdiomPrefixTree*> &matched);
+    double calcBackwardWeights(int cur, Address addr, IdiomPrefixTree *tree, std::set<IdiomPrefixTree*> &matched,
+                               const DecodeTable *table);
     // Enforce the overlapping constraints and
     // return true if the cur_addr doesn't conflict with other identified functions,
     // otherwise return false
@@ -187,7 +210,11 @@ class ProbabilityCalculator {
 				       dyn_hash_map<Address, double> &newFEPProb,
 				       dyn_hash_map<Address, double> &newReachingProb,
 				       dyn_hash_set<Function*> &newDiscoveredFuncs);
-    bool decodeInstruction(DecodeData &data, Address addr);
+    bool decodeInstruction(DecodeData &data, Address addr, const DecodeTable *table = NULL);
+    void decodeAt(DecodeData &data, Address addr) const;
+    // Whether the instruction at addr ends exactly at end, decoding
+    // only its length if it has not been decoded before
+    bool endsAt(Address addr, Address end, const DecodeTable *table = NULL);
 
     void Finalize(dyn_hash_map<Address, double> &newFEPProb,
                   dyn_hash_map<Address, double> &newReachingProb,
@@ -204,6 +231,10 @@ public:
 		finalized.clear();
 	}
     double calcProbByMatchingIdioms(Address addr);
+    // Score every code offset in the given [start, end) ranges,
+    // spreading the work over nthreads threads
+    void calcProbByMatchingIdioms(const std::vector<std::pair<Address, Address> > &gaps,
+                                  unsigned nthreads);
     void calcProbByEnforcingConstraints();
     double getFEPProb(Address addr);
     bool isFEP(Address addr);
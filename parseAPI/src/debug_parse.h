@@ -78,5 +78,6 @@ extern const std::string PARSE_TAILCALL_FAIL;
 
 extern const std::string PARSE_TOTAL_TIME;
 extern const std::string PARSE_JUMPTABLE_TIME;
+extern const std::string PARSE_PREFETCH_TIME;
 
 #endif
@@ -34,59 +34,42 @@
 #include "dyntypes.h"
 #include "CFG.h"
 #include <unordered_map>
+#include <map>
 #include <set>
-
-using namespace std;
+#include <vector>
 
 namespace Dyninst{
 namespace ParseAPI{
 
-class dominatorCFG;
-class dominatorBB;
-
-class dominatorBB {
-   friend class dominatorCFG;
-protected:
-   int dfs_no;
-   int size;
-   dominatorBB *semiDom;
-   dominatorBB *immDom;
-   dominatorBB *label;
-   dominatorBB *ancestor;
-   dominatorBB *parent;
-   dominatorBB *child;
-
-   Block *parseBlock;
-   dominatorCFG *dom_cfg;
-
-   std::set<dominatorBB *> bucket;
-   vector<dominatorBB *> pred;
-   vector<dominatorBB *> succ;   
- public:
-   dominatorBB(Block *bb, dominatorCFG *dc);
-   ~dominatorBB();
-   dominatorBB *eval();
-   void compress();
-   int sdno();
-};
-
+/*
+ * Dominator and post-dominator computation for a single function,
+ * using the iterative algorithm of Cooper, Harvey and Kennedy over
+ * a dense copy of the CFG.  Blocks are numbered once; node 0 is a
+ * virtual root that links to every entry (or, for post-dominators,
+ * every exit) so that unreachable and multi-entry code is handled.
+ * Edges and the dominator tree are plain int arrays indexed by node.
+ */
 class dominatorCFG {
-   friend class dominatorBB;
  protected:
-   std::unordered_map<Address, dominatorBB *> map_;
    const Function *func;
-   vector<dominatorBB *> all_blocks;
-   vector<dominatorBB *> sorted_blocks;
-   int currentDepthNo;
+   std::vector<Block *> blocks_;             // node -> block; blocks_[0] is NULL
+   std::unordered_map<Block *, int> index_;  // block -> node
+
+   // Predecessors of node n are preds_[pred_start_[n] .. pred_start_[n+1])
+   std::vector<int> pred_start_;
+   std::vector<int> preds_;
+   std::vector<int> succ_start_;
+   std::vector<int> succs_;
 
-   dominatorBB *entryBlock;
-   dominatorBB *nullNode;
+   std::vector<int> order_;    // reachable nodes in reverse postorder
+   std::vector<int> po_num_;   // node -> postorder number, -1 if unreachable
+   std::vector<int> idom_;     // node -> immediate dominator, -1 if none
 
+   void buildGraph(bool reverse);
    void performComputation();
-   void depthFirstSearch(dominatorBB *v);
-   void eval(dominatorBB *v);
-   void link(dominatorBB *v, dominatorBB *w);
-   dominatorBB *parseToDomBB(Block *bb);
+   int intersect(int a, int b) const;
+   void storeResults(std::map<Block *, Block *> &idom,
+                     std::map<Block *, std::set<Block *> *> &dominates) const;
 
  public:
    dominatorCFG(const Function *f);
@@ -43,11 +43,14 @@ namespace Stackwalker {
 
 class Walker;
 class FrameStepper;
+class int_sampler;
+class int_walkerSet;
 
 class SW_EXPORT Frame : public AnnotatableDense {
   friend class Walker;
   friend class CallTree;
   friend class ::StackCallback;
+  friend class int_sampler;
 protected:
   Dyninst::MachRegisterVal ra;
   Dyninst::MachRegisterVal fp;
@@ -192,6 +195,7 @@ class SW_EXPORT FrameNode {
 
 class SW_EXPORT CallTree {
    friend class WalkerSet;
+   friend class int_walkerSet;
   public:
 
    CallTree(frame_cmp_t cmpf = frame_addr_cmp);
@@ -208,6 +212,12 @@ class SW_EXPORT CallTree {
   private:
    FrameNode *head;
    frame_cmp_wrapper cmp_wrapper;
+
+   //Moves the stacks of 'from', built by walker 'helper', into this tree
+   // as if 'owner' had walked them.  'from' is left empty.
+   void adopt(CallTree &from, Walker *helper, Walker *owner);
+   static void rebindWalker(FrameNode *node, Walker *helper, Walker *owner);
+   static void mergeNode(FrameNode *from, FrameNode *to);
 };
 
 }
@@ -50,6 +50,7 @@ namespace Stackwalker {
 class LibraryState;
 class ThreadState;
 class Walker;
+class int_walkerSet;
 
 class SW_EXPORT ProcessState {
    friend class Walker;
@@ -122,11 +123,31 @@ class ProcSelf : public ProcessState {
 };
 
 class SW_EXPORT ProcDebug : public ProcessState {
+   friend class int_walkerSet;
  protected:
    Dyninst::ProcControlAPI::Process::ptr proc;
    ProcDebug(Dyninst::ProcControlAPI::Process::ptr p);
 
    std::set<Dyninst::ProcControlAPI::Thread::ptr> needs_resume;
+   //Registers read in bulk by WalkerSet::walkStacks, valid while the
+   // process is held stopped for it
+   std::map<Dyninst::ProcControlAPI::Thread::ptr, Dyninst::ProcControlAPI::RegisterPool> cached_regs;
+
+   //Copy of the walked thread's stack, from its stack pointer up, read in
+   // one operation by preStackwalk and used to satisfy readMem
+   std::vector<char> stack_copy;
+   Dyninst::Address stack_copy_addr;
+   size_t stack_snapshot_size;
+   std::map<Dyninst::THR_ID, Dyninst::Address> stack_ends;
+   void snapshotStack(Dyninst::THR_ID tid);
+   bool copyStack(Dyninst::THR_ID tid, Dyninst::Address &start, std::vector<char> &buf);
+
+   //Set while WalkerSet::walkStacks holds the process stopped, with a
+   // copy of every thread's stack keyed by its start.  Its threads may
+   // then be walked concurrently.
+   bool bulk_walk;
+   std::map<Dyninst::Address, std::vector<char> > bulk_stacks;
+   bool getStackEnd(Dyninst::THR_ID tid, Dyninst::Address sp, Dyninst::Address &end);
  public:
   
   static ProcDebug *newProcDebug(Dyninst::PID pid, std::string executable="");
@@ -146,6 +167,10 @@ class SW_EXPORT ProcDebug : public ProcessState {
   virtual bool preStackwalk(Dyninst::THR_ID tid);
   virtual bool postStackwalk(Dyninst::THR_ID tid);
 
+  //Number of bytes of a thread's stack, from its stack pointer up, read
+  // in one operation at the start of each stackwalk.  0 disables.
+  void setStackSnapshotSize(size_t bytes);
+  size_t getStackSnapshotSize() const;
   
   virtual bool pause(Dyninst::THR_ID tid = NULL_THR_ID);
   virtual bool resume(Dyninst::THR_ID tid = NULL_THR_ID);
@@ -0,0 +1,95 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef SAMPLER_H_
+#define SAMPLER_H_
+
+#include "basetypes.h"
+#include "frame.h"
+#include <vector>
+
+namespace Dyninst {
+namespace Stackwalker {
+
+class Walker;
+class int_sampler;
+
+class SW_EXPORT SampleCallback {
+ public:
+   virtual ~SampleCallback();
+
+   //Called for each recorded sample, top frame first.  Frame names are
+   // looked up through the Walker's SymbolLookup.
+   virtual void handleSample(Dyninst::THR_ID thread, const std::vector<Frame> &stack) = 0;
+};
+
+//Records call stacks of the current process from signal handlers.  The
+// walk follows frame pointers, does not allocate or lock, and stores raw
+// return addresses into a per-thread ring buffer.  Samples are turned into
+// Frames later, outside the handler, by processSamples or the symbolizer
+// thread.
+class SW_EXPORT Sampler {
+ private:
+   int_sampler *isampler;
+   Sampler(int_sampler *s);
+ public:
+   //walker must operate on the current process.  Each sample keeps at most
+   // max_frames frames, and each thread buffers up to ring_size samples;
+   // samples taken while a thread's buffer is full are dropped.
+   static Sampler *newSampler(Walker *walker, unsigned max_frames = 128,
+                              unsigned ring_size = 256);
+   ~Sampler();
+
+   //Allocate the calling thread's buffer.  Must be called by each thread,
+   // outside of a signal handler, before it takes samples.
+   bool registerThread();
+   void unregisterThread();
+
+   //Async-signal-safe.  Record the calling thread's call stack.  context
+   // is the ucontext_t passed to an SA_SIGINFO handler; if NULL the walk
+   // starts at the caller of sample.
+   bool sample(void *context = NULL);
+
+   //Deliver the samples recorded so far to cb.  Returns the number of
+   // samples delivered.
+   unsigned processSamples(SampleCallback *cb);
+
+   //Run processSamples on a background thread every interval_ms
+   // milliseconds until stopSymbolizer is called.
+   bool startSymbolizer(SampleCallback *cb, unsigned interval_ms = 10);
+   void stopSymbolizer();
+
+   unsigned long droppedSamples() const;
+};
+
+}
+}
+
+#endif
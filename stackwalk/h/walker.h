@@ -35,6 +35,7 @@
 #include "PCProcess.h"
 #include <vector>
 #include <list>
+#include <set>
 #include <string>
 #include <utility>
 
@@ -95,6 +96,12 @@ class SW_EXPORT Walker {
    bool checkValidFrame(const Frame &in, const Frame &out);
    bool callPreStackwalk(THR_ID tid = NULL_THR_ID);
    bool callPostStackwalk(THR_ID tid = NULL_THR_ID);
+
+   //Helper walkers let WalkerSet::walkStacks walk several threads of this
+   // process at once, one per helper.
+   friend class int_walkerSet;
+   unsigned prepareHelpers(unsigned n);
+   Walker *getHelper(unsigned i);
  public:
    static void version(int& major, int& minor, int& maintenance);
    //Create an object that operates on the current process
@@ -166,6 +173,14 @@ class SW_EXPORT Walker {
    StepperGroup *group;
    unsigned call_count;
    static SymbolReaderFactory *symrfact;
+
+   //True if built with the default steppers, group and lookup, which
+   // helpers can copy
+   bool default_config;
+   //For a helper, the walker it helps.  A helper shares its ProcessState.
+   Walker *primary;
+   std::vector<Walker *> helpers;
+   std::set<std::pair<std::string, Dyninst::Address> > helper_libs;
 };
 
 class SW_EXPORT WalkerSet {
@@ -193,6 +208,12 @@ class SW_EXPORT WalkerSet {
    size_t size() const;
 
    bool walkStacks(CallTree &tree, bool walk_initial_only = false) const;
+
+   // Number of threads used by walkStacks.  The threads of a stopped
+   // process are split among helper Walkers, so a set holding one
+   // process with many threads is also walked in parallel.  Defaults to 1.
+   void setWalkThreads(unsigned n);
+   unsigned getWalkThreads() const;
 };
 
 }
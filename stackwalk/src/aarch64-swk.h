@@ -7,6 +7,7 @@
 #include "common/h/dyntypes.h"
 
 #include "common/src/lru_cache.h"
+#include "common/src/dthread.h"
 
 namespace Dyninst {
 namespace Stackwalker {
@@ -20,10 +21,10 @@ private:
 
    void updateCache(Address addr, FrameFuncHelper::alloc_frame_t result);
    bool checkCache(Address addr, FrameFuncHelper::alloc_frame_t &result);
-   // We need some kind of re-entrant safe synhronization before we can
-   // globally turn this caching on, but it would sure help things.
+   //Shared by the walkers of a process, guarded by cache_lock
    static const unsigned int cache_size = 64;
    LRUCache<Address, FrameFuncHelper::alloc_frame_t> cache;
+   Mutex<false> cache_lock;
 public:
    static aarch64_LookupFuncStart *getLookupFuncStart(ProcessState *p);
    void releaseMe();
@@ -35,6 +35,7 @@
 #include "dataflowAPI/h/stackanalysis.h"
 #include "dataflowAPI/h/Absloc.h"
 #include "SymReader.h"
+#include "common/src/dthread.h"
 
 #include <string>
 
@@ -75,6 +76,9 @@ class AnalysisStepperImpl : public FrameStepper
    static std::map<std::string, ParseAPI::CodeObject *> objs;
    static std::map<std::string, ParseAPI::CodeSource*> srcs;
    static std::map<std::string, SymReader*> readers;
+   //Guards the maps above and the parsing and analysis of their shared
+   // CodeObjects, which WalkerSet::walkStacks may reach from several threads
+   static Mutex<false> analysis_lock;
    
    static ParseAPI::CodeObject *getCodeObject(std::string name);
    static ParseAPI::CodeSource *getCodeSource(std::string name);
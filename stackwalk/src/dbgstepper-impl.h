@@ -43,6 +43,9 @@ typedef boost::shared_ptr<DwarfFrameParser> DwarfFrameParserPtr;
 
 namespace Stackwalker {
 
+class SharedFrameInfo;
+typedef boost::shared_ptr<SharedFrameInfo> SharedFrameInfoPtr;
+
 class DebugStepperImpl : public FrameStepper, public Dyninst::ProcessReader {
  private:
     struct cache_t {
@@ -57,6 +60,11 @@ class DebugStepperImpl : public FrameStepper, public Dyninst::ProcessReader {
 
     dyn_hash_map<Address, cache_t> cache_;
 
+    // The frame info of each library this stepper has walked through.
+    // Only this stepper's thread touches it, so lookups take no locks.
+    dyn_hash_map<std::string, SharedFrameInfoPtr> frame_info_;
+    DwarfDyninst::DwarfFrameParserPtr getFrameParser(const std::string &lib);
+
     void addToCache(const Frame &cur, const Frame &caller);
     bool lookupInCache(const Frame &cur, Frame &caller);
 
@@ -72,6 +80,7 @@ class DebugStepperImpl : public FrameStepper, public Dyninst::ProcessReader {
   DebugStepperImpl(Walker *w, DebugStepper *parent);
   virtual gcframe_ret_t getCallerFrame(const Frame &in, Frame &out);
   virtual unsigned getPriority() const;
+  virtual void newLibraryNotification(LibAddrPair *la, lib_change_t change);
   virtual void registerStepperGroup(StepperGroup *group);
   virtual bool ReadMem(Address addr, void *buffer, unsigned size);
   virtual bool GetReg(MachRegister reg, MachRegisterVal &val);
@@ -82,6 +91,8 @@ class DebugStepperImpl : public FrameStepper, public Dyninst::ProcessReader {
  protected:
   gcframe_ret_t getCallerFrameArch(Address pc, const Frame &in, Frame &out, 
                                    DwarfDyninst::DwarfFrameParserPtr dinfo, bool isVsyscallPage);
+  bool getCallerFrameTable(Address pc, const Frame &in, Frame &out,
+                           DwarfDyninst::DwarfFrameParserPtr dinfo);
   bool isFrameRegister(MachRegister reg);
   bool isStackRegister(MachRegister reg);
 };
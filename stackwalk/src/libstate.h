@@ -35,6 +35,7 @@
 #include "common/h/SymReader.h"
 #include "stackwalk/h/procstate.h"
 #include "common/src/addrtranslate.h"
+#include "common/src/dthread.h"
 #include <set>
 
 namespace Dyninst {
@@ -93,6 +94,7 @@ SymbolReaderFactory *getDefaultSymbolReader();
 
 class LibraryWrapper {
   private:
+   Mutex<false> lock;
    std::map<std::string, SymReader *> file_map;
   public:
    static SymReader *testLibrary(std::string filename);
@@ -107,6 +107,7 @@ public:
 class DyninstInstrStepperImpl : public FrameStepper {
  private:
    static std::map<SymReader *, bool> isRewritten;
+   static Mutex<false> isRewrittenLock;
    DyninstInstrStepper *parent;
 
  public:
@@ -164,10 +165,18 @@ private:
    void clearProcSet();
    void initProcSet();
    bool walkStacksProcSet(CallTree &tree, bool &bad_plat, bool walk_iniital_only);
+   void beginBulkWalk(bool walk_initial_only);
+   void endBulkWalk();
+   bool walkStacksParallel(CallTree &tree, bool walk_initial_only);
+   //True if beginBulkWalk stopped w's process and copied its stacks, and
+   // w can be copied, so that helpers may walk its threads
+   bool canSplitThreads(Walker *w);
 
    unsigned non_pd_walkers;
+   unsigned walk_threads;
    set<Walker *> walkers;
    void *procset; //Opaque pointer, will refer to a ProcControl::ProcessSet in some situations
+   void *stopped_procset; //Processes stopped by beginBulkWalk, resumed by endBulkWalk
 };
 
 }
@@ -31,8 +31,10 @@
 #include "common/h/SymReader.h"
 #include "Elf_X.h"
 #include "common/src/headers.h"
+#include "common/src/dthread.h"
 
 #include <map>
+#include <atomic>
 
 namespace Dyninst {
 
@@ -61,6 +63,10 @@ class SYMLITE_EXPORT SymElf : public Dyninst::SymReader
 
    SymCacheEntry *cache;
    unsigned cache_size;
+   //A reader may be shared by threads walking stacks in parallel.
+   // cache_lock guards building the cache and its demangled names.
+   Mutex<false> cache_lock;
+   std::atomic<bool> cache_ready;
 
    Elf_X_Shdr *sym_sections;
    unsigned sym_sections_size;
@@ -81,6 +81,7 @@ class SYMTAB_EXPORT typeCollection : public Serializable//, public AnnotatableSp
     friend class Module;
     friend class Type;
     friend class DwarfWalker;
+    friend class DwarfTypeIndex;
 
     dyn_hash_map<std::string, Type *> typesByName;
     dyn_hash_map<std::string, Type *> globalVarsByName;
@@ -67,6 +67,18 @@ public:
 
       void addLineInfo(LineInformation *lineInfo);	      
 
+    /* A line table row, for adding many at once. */
+    struct Row {
+        unsigned int fileIndex;
+        unsigned int lineNo;
+        unsigned int lineOffset;
+        Offset lowInclusiveAddr;
+        Offset highExclusiveAddr;
+    };
+    /* Same as calling addLine() on each row in order; rows are sorted
+       by address first so each insertion starts at its predecessor. */
+    void addLines(std::vector<Row> &rows);
+
       bool addAddressRange( Offset lowInclusiveAddr, 
             Offset highExclusiveAddr, 
             const char * lineSource, 
@@ -77,6 +89,15 @@ public:
       bool getSourceLines(Offset addressInRange, std::vector<Statement_t> &lines);
     bool getSourceLines(Offset addressInRange, std::vector<Statement> &lines);
 
+    /* Moves the line map into a flat, address-sorted form that
+       getSourceLines() searches instead of the tree indices, for maps
+       that are queried often and no longer change.  The tree indices
+       are freed.  Adding a line, or any call that returns an iterator,
+       rebuilds them and discards the flat form; such calls must not run
+       concurrently with queries. */
+    void freeze();
+    bool isFrozen() const;
+
       bool getAddressRanges( const char * lineSource, unsigned int LineNo, std::vector< AddressRange > & ranges );
       const_line_info_iterator begin_by_source() const;
       const_line_info_iterator end_by_source() const;
@@ -103,6 +124,12 @@ public:
 protected:
     mutable int wasted_compares;
     mutable int num_queries;
+
+private:
+    struct FlatIndex;
+    boost::shared_ptr<FlatIndex> flat_;
+    void thaw() const;
+    size_t findFlat(Offset addressInRange, std::vector<size_t> &rows) const;
 };
 
 
@@ -32,6 +32,7 @@
 #define __SYMTAB_H__
 
 #include <set>
+#include <atomic>
 
 #include "Symbol.h"
 #include "Module.h"
@@ -90,6 +91,19 @@ typedef IBSTree< ModRange > ModRangeLookup;
 typedef IBSTree<FuncRange> FuncRangeLookup;
 typedef Dyninst::ProcessReader MemRegReader;
 
+// What Symtab::symbolize found for one offset
+struct SYMTAB_EXPORT SymbolizedOffset {
+   SymbolizedOffset() : offset(0), function(NULL), inlined(NULL) {}
+   Offset offset;
+   // As from getContainingFunction
+   Function *function;
+   // As from getContainingInlinedFunction; its inlined parents make up
+   // the rest of the inline chain
+   FunctionBase *inlined;
+   // As from getSourceLines
+   std::vector<Statement::Ptr> lines;
+};
+
 class SYMTAB_EXPORT Symtab : public LookupInterface,
                public Serializable,
                public AnnotatableSparse
@@ -97,6 +111,7 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
    friend class Archive;
    friend class Symbol;
    friend class Function;
+   friend class FunctionBase;
    friend class Variable;
    friend class Module;
    friend class Region;
@@ -179,6 +194,10 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
    bool getContainingFunction(Offset offset, Function* &func);
    //Searches for functions and returns inlined instances
    bool getContainingInlinedFunction(Offset offset, FunctionBase* &func);
+   //Looks up the function, inlined function and source lines of many
+   //offsets in one pass; results[i] describes offsets[i]
+   bool symbolize(const std::vector<Offset> &offsets,
+                  std::vector<SymbolizedOffset> &results);
 
    // Variable
    bool findVariableByOffset(Variable *&ret, const Offset offset);
@@ -266,6 +285,21 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
 
    bool addType(Type *typ);
 
+   // Number of threads used to parse DWARF type information; compilation
+   // units are divided among them by module.  Defaults to 1.
+   void setTypeParseThreads(unsigned n);
+   unsigned getTypeParseThreads();
+
+   // Number of threads used to decode DWARF line tables when all line
+   // information is parsed.  Defaults to 1.
+   void setLineParseThreads(unsigned n);
+   unsigned getLineParseThreads();
+
+   // Parse the type information of only the modules that a query needs,
+   // rather than of the whole object at the first query.  Off by default.
+   void setLazyTypeParsing(bool value);
+   bool getLazyTypeParsing();
+
    static boost::shared_ptr<builtInTypeCollection> builtInTypes();
    static boost::shared_ptr<typeCollection> stdTypes();
 
@@ -439,6 +473,7 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
 
  private:
    void createDefaultModule();
+   void sortEveryFunction();
 
    Module *newModule(const std::string &name, const Offset addr, supportedLanguages lang);
    
@@ -454,6 +489,9 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
    void parseLineInformation();
    
    void parseTypes();
+   void parseModuleTypes(Module *mod);
+   void parseTypesAt(Module *mod, Offset addr);
+   void parseVariableTypes(Variable *var);
    bool setDefaultNamespacePrefix(std::string &str);
 
    bool addUserRegion(Region *newreg);
@@ -538,7 +576,9 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
    indexed_symbols undefDynSyms;
    
    // We also need per-Aggregate indices
-   bool sorted_everyFunction;
+   // Set once everyFunction is sorted by address; lookups sort it on
+   // demand and may come from several threads
+   std::atomic<bool> sorted_everyFunction;
    std::vector<Function *> everyFunction;
    // Since Functions are unique by address we require this structure to
    // efficiently track them.
@@ -34,6 +34,7 @@
 #include "Serialization.h"
 #include "Annotatable.h"
 #include "symutil.h"
+#include <atomic>
 
 namespace Dyninst{
 namespace SymtabAPI{
@@ -171,10 +172,19 @@ class SYMTAB_EXPORT Type : public Serializable, public  TYPE_ANNOTATABLE_CLASS
     **/
    bool updatingSize;
    
-   static typeId_t USER_TYPE_ID;
+   static std::atomic<typeId_t> USER_TYPE_ID;
+   static typeId_t nextUserTypeID();
 
    // INTERNAL DATA MEMBERS
-   unsigned int refCount;
+   // Updated atomically, but still copied along with the rest of a type
+   // (see upgradePlaceholder)
+   struct RefCount : public std::atomic<unsigned int> {
+      RefCount(unsigned int v) : std::atomic<unsigned int>(v) {}
+      RefCount(const RefCount &o) : std::atomic<unsigned int>(o.load()) {}
+      RefCount &operator=(const RefCount &o) { store(o.load()); return *this; }
+      RefCount &operator=(unsigned int v) { store(v); return *this; }
+   };
+   RefCount refCount;
 
 protected:
    virtual void updateSize() {}
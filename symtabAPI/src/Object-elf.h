@@ -258,6 +258,7 @@ class stab_entry_64 : public stab_entry {
 
 class pdElfShdr;
 class Symtab;
+class DwarfTypeIndex;
 class Region;
 class Object;
 
@@ -399,6 +400,15 @@ public:
 
     virtual void setTruncateLinePaths(bool value);
     virtual bool getTruncateLinePaths();
+    virtual void setTypeParseThreads(unsigned n);
+    virtual unsigned getTypeParseThreads();
+    virtual void setLineParseThreads(unsigned n);
+    virtual unsigned getLineParseThreads();
+    virtual void setLazyTypeParsing(bool value);
+    virtual bool getLazyTypeParsing();
+    virtual bool parseModuleTypeInfo(Module *mod);
+    virtual bool parseTypeInfoAt(Module *mod, Offset addr);
+    virtual bool parseTypeInfoNamed(const std::string &name, bool variable);
     
     Elf_X * getElfHandle() { return elfHdr; }
 
@@ -528,6 +538,19 @@ public:
 
 private:
     void parseLineInfoForCU(Module::DebugInfoT cuDIE, LineInformation* li);
+
+    // A compilation unit's line table, decoded but not yet added to a
+    // LineInformation; file indices are relative to files.
+    struct CULineTable {
+        std::vector<StringTableEntry> files;
+        std::vector<LineInformation::Row> rows;
+    };
+    bool decodeLineInfoForCU(Dwarf_Die cuDIE, CULineTable &table);
+    void addLineInfoForCU(CULineTable &table, LineInformation *li);
+    // Decodes every CU's line table on nthreads threads, for
+    // parseLineInfoForCU to pick up.
+    void decodeAllLineInfo(unsigned nthreads);
+    std::map<Dwarf_Off, CULineTable> decodedLines_;
     
     LineInformation* li_for_object;
     LineInformation* parseLineInfoForObject(StringTablePtr strings);
@@ -601,6 +624,11 @@ private:
   std::vector<std::pair<long, long> > new_dynamic_entries;
  private:
   const char* soname_;
+  unsigned typeParseThreads_;
+  unsigned lineParseThreads_;
+  bool lazyTypeParsing_;
+  DwarfTypeIndex *typeIndex_;
+  DwarfTypeIndex *typeIndex();
   
 };
 
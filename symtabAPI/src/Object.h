@@ -58,6 +58,7 @@ namespace SymtabAPI{
 extern bool symbol_compare(const Symbol *s1, const Symbol *s2);
 
 class Symtab;
+class Module;
 class Region;
 class ExceptionBlock;
 class relocationEntry;
@@ -139,6 +140,17 @@ public:
 
     virtual void setTruncateLinePaths(bool value);
     virtual bool getTruncateLinePaths();
+    virtual void setTypeParseThreads(unsigned n);
+    virtual unsigned getTypeParseThreads();
+    virtual void setLineParseThreads(unsigned n);
+    virtual unsigned getLineParseThreads();
+    // On-demand type parsing; each parse* call returns false if the
+    // object cannot parse that part alone, and everything must be parsed.
+    virtual void setLazyTypeParsing(bool value);
+    virtual bool getLazyTypeParsing();
+    virtual bool parseModuleTypeInfo(Module *mod);
+    virtual bool parseTypeInfoAt(Module *mod, Offset addr);
+    virtual bool parseTypeInfoNamed(const std::string &name, bool variable);
     virtual Region::RegionType getRelType() const { return Region::RT_INVALID; }
 
     // Only implemented for ELF right now
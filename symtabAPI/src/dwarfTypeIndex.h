@@ -0,0 +1,100 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ *
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ *
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(_dwarf_type_index_h_)
+#define _dwarf_type_index_h_
+
+#include "dwarfWalker.h"
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace Dyninst {
+
+class Elf_X;
+
+namespace SymtabAPI {
+
+// An index of the units in a file's type information, for parsing only
+// the units that a query needs.  Type and variable names come from the
+// .gdb_index or .debug_names section when the file has one, and from the
+// top-level DIEs of every unit otherwise.  Units are parsed a module at a
+// time by a single walker, so type IDs and the set of parsed functions
+// carry over from one request to the next.
+class DwarfTypeIndex {
+  public:
+    DwarfTypeIndex(Symtab *symtab, ::Dwarf *dbg, Elf_X *elf);
+
+    // Each of these returns false if a unit it parsed was malformed.
+    bool parseModule(Module *mod);
+    // Parses the module of the unit covering addr, or mod if none does.
+    bool parseAddress(Module *mod, Offset addr);
+    // Parses every module with a unit that defines the given type or
+    // global variable.
+    bool parseName(const std::string &name, bool variable);
+    bool parseAll();
+
+  private:
+    struct Unit {
+        Unit(Dwarf_Off o, size_t h, bool i) :
+            offset(o), header_length(h), is_info(i), mod(NULL) {}
+        Dwarf_Off offset;
+        size_t header_length;
+        bool is_info;
+        Module *mod;
+    };
+    typedef std::map<std::string, std::vector<size_t> > NameMap;
+
+    bool getUnitDie(const Unit &u, Dwarf_Die &die);
+    bool findUnit(Dwarf_Off offset, bool is_info, size_t &unit);
+    void addName(NameMap &names, const std::string &name, size_t unit);
+    bool readGdbIndex(const unsigned char *data, size_t size);
+    bool readDebugNames(const unsigned char *data, size_t size,
+                        const char *strs, size_t strs_size, bool big_endian);
+    void scanScope(Dwarf_Die scope, size_t unit);
+
+    Symtab *symtab_;
+    ::Dwarf *dbg_;
+    DwarfWalker walker_;
+    std::vector<Unit> units_;
+    std::map<Module *, std::vector<size_t> > module_units_;
+    std::map<Dwarf_Off, size_t> info_units_;
+    std::map<Dwarf_Off, size_t> types_units_;
+    NameMap type_names_;
+    NameMap var_names_;
+    std::set<Module *> parsed_;
+    bool busy_;
+};
+
+}
+}
+
+#endif
@@ -18,6 +18,8 @@
 #include "Object.h"
 #include <boost/shared_ptr.hpp>
 #include <Collections.h>
+#include "common/src/dthread.h"
+#include "common/src/striped_hash_map.h"
 
 namespace Dyninst {
 namespace SymtabAPI {
@@ -34,11 +36,13 @@ class typeEnum;
 class fieldListType;
 class typeCollection;
 class Type;
+class Variable;
 
 class DwarfParseActions {
 
 protected:
     Dwarf* dbg() { return dbg_; } 
+    void setDbg(Dwarf* d) { dbg_ = d; }
 
     Module *& mod() { return mod_; } 
 
@@ -182,6 +186,23 @@ protected:
 
 }; // class DwarfParseActions 
 
+// libdw caches abbreviations and unit lookups inside the Dwarf handle
+// without locking, so every worker reads through a handle of its own:
+// the given one and up to n-1 more opened on the same file.
+class DwarfHandlePool {
+  public:
+    DwarfHandlePool(::Dwarf *dbg, unsigned n);
+    ~DwarfHandlePool();
+    unsigned size() const { return size_; }
+    ::Dwarf *get();
+    void put(::Dwarf *d);
+  private:
+    Mutex<false> lock_;
+    std::vector< ::Dwarf *> free_;
+    std::vector< ::Dwarf *> extra_;
+    unsigned size_;
+};
+
 struct ContextGuard {
     DwarfParseActions& c;
     ContextGuard(DwarfParseActions& c): c(c) { c.push(); }
@@ -217,15 +238,54 @@ public:
             compile_offset(o.compile_offset),
             info_type_ids_(o.info_type_ids_),
             types_type_ids_(o.types_type_ids_),
-            sig8_type_ids_(o.sig8_type_ids_) {}
+            shared_type_ids_(o.shared_type_ids_),
+            id_block_next_(0),
+            id_block_end_(0),
+            sig8_type_ids_(o.sig8_type_ids_),
+            pending_(o.pending_),
+            symtab_lock_(o.symtab_lock_),
+            func_owners_(o.func_owners_),
+            unit_index_(o.unit_index_),
+            unowned_(o.unowned_) {}
 
     virtual ~DwarfWalker();
 
     bool parse();
 
+    // Parse with the compilation units divided among nthreads threads,
+    // one module at a time per thread.  Each function's children are
+    // parsed by the first unit that defines it, as in parse(), and
+    // updates to Symtab-owned objects are applied afterwards in unit
+    // order.  Falls back to parse() for a single thread.
+    bool parseParallel(unsigned nthreads);
+
+    // A change to an object shared with the rest of the Symtab that a
+    // parallel parse records per unit rather than making immediately.
+    struct PendingUpdate {
+        enum Kind { MangledName, PrettyName, CallsiteFile, VariableType };
+        Kind kind;
+        FunctionBase *func;
+        Variable *var;
+        Type *type;
+        std::string str;
+    };
+    static void applyPending(const std::vector<PendingUpdate> &updates);
+
     // Takes current debug state as represented by dbg_;
     bool parseModule(bool is_info, Module *&fixUnknownMod);
 
+    // Sets up the context for the unit in current_cu_die and maps it to
+    // a Symtab module, looking the module up by name unless one is given.
+    bool setupModule(Module *known = NULL);
+
+    // For parsing a unit at a time (see DwarfTypeIndex).  The type unit
+    // signatures of the whole file must be found first, and a module's
+    // types fixed up once all of its units have been parsed.
+    void findAllSig8Types();
+    Module *unitModule(Dwarf_Die cu);
+    bool parseUnit(Dwarf_Die cu, Dwarf_Off offset, Module *mod);
+    bool fixupModuleTypes(Module *fixUnknownMod);
+
     // Non-recursive version of parse
     // A Context must be provided as an _input_ to this function,
     // whereas parse creates a context.
@@ -240,6 +300,9 @@ private:
     };
 
     bool parseSubprogram(inline_t func_type);
+    void addFuncName(FunctionBase *func);
+    bool ownsFunc(FunctionBase *func);
+    static void findSubprogramEntries(Dwarf_Die die, std::vector<Address> &entries);
     bool parseLexicalBlock();
     bool parseRangeTypes(Dwarf* dbg, Dwarf_Die die);
     bool parseCommonBlock();
@@ -396,15 +459,35 @@ private:
     // either .debug_info or .debug_types.
     dyn_hash_map<Dwarf_Off, typeId_t> info_type_ids_; // .debug_info offset -> id
     dyn_hash_map<Dwarf_Off, typeId_t> types_type_ids_; // .debug_types offset -> id
+    // A parallel parse shares one pair of maps among its workers instead,
+    // and each worker hands out IDs from a block it took from the global
+    // counter, so that IDs are unique across all of them.
+    struct SharedTypeIds {
+        striped_hash_map<Dwarf_Off, typeId_t> info;
+        striped_hash_map<Dwarf_Off, typeId_t> types;
+    };
+    SharedTypeIds *shared_type_ids_;
+    typeId_t id_block_next_;
+    typeId_t id_block_end_;
     typeId_t get_type_id(Dwarf_Off offset, bool is_info);
     typeId_t type_id(); // get_type_id() for the current entry
 
     // Map to connect DW_FORM_ref_sig8 to type IDs.
     dyn_hash_map<uint64_t, typeId_t> sig8_type_ids_;
     bool parseModuleSig8(bool is_info);
-    void findAllSig8Types();
     bool findSig8Type(Dwarf_Sig8 * signature, Type *&type);
 
+    // Parallel parse state, all unset for a serial parse.  Symtab lookups
+    // are serialized on symtab_lock_, updates are queued on pending_, and
+    // func_owners_ maps each function to the unit that parses its children.
+    // Subprograms whose function no unit owns are recorded on unowned_
+    // and parsed serially once the workers are done.
+    std::vector<PendingUpdate> *pending_;
+    Mutex<false> *symtab_lock_;
+    const dyn_hash_map<FunctionBase *, size_t> *func_owners_;
+    size_t unit_index_;
+    std::vector<Dwarf_Off> *unowned_;
+
 protected:
     virtual void setFuncReturnType();
 